@@ -2,8 +2,13 @@
 #define APPLICATION_H
 
 #include <SDL.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include "Graphics.hpp"
 
 class Graphics;
@@ -17,25 +22,48 @@ struct Window {
 
 class Application {
 public:
+    // Timing of the main thread's fixed UI tick, as measured between consecutive ticks.
+    struct TickStats {
+        float TargetMs = 0.0f;
+        float JitterMs = 0.0f;      // moving average of |interval - target|
+        float MaxJitterMs = 0.0f;   // worst deviation over the last second
+    };
+
     Application();
     Application(const std::string& title, const unsigned int& width, const unsigned int& height);
     ~Application();
 
     void Run();
+    void EnableBenchmark(const std::string& outputPath, const int& widgetCount);
     SDL_Window* GetWindowHandler() const { return m_window.handler; }
-    bool GetSwapChainRebuild() const { return m_SwapChainRebuild; }
+    const TickStats& GetTickStats() const { return m_tickStats; }
 
-    void SetSwapChainRebuild(const bool& enable) { m_SwapChainRebuild = enable; }
+    // Called from the render thread when the swap chain is out of date; the main thread performs the rebuild.
+    void RequestSwapChainRebuild() { m_SwapChainRebuild.store(true, std::memory_order_release); }
 
 private:
     void InitSDLWindow();
     void InitVulkan();
 
+    void RenderLoop();
+    void RebuildSwapChainIfRequested();
+    void UpdateTickStats(std::chrono::steady_clock::duration interval);
+
     Window m_window;
     std::shared_ptr<Graphics> m_graphics = nullptr;
 
     bool m_shouldClose = false;
-    bool m_SwapChainRebuild = false;
+
+    TickStats m_tickStats {};
+    float m_tickJitterPeak = 0.0f;
+    uint32_t m_tickJitterWindow = 0;
+
+    // Main thread pumps events and ticks the UI, the render thread records, submits and presents.
+    // The render thread holds m_renderMutex for each frame; the main thread takes it to rebuild the swap chain.
+    std::thread m_renderThread;
+    std::mutex m_renderMutex;
+    std::atomic<bool> m_renderThreadStop { false };
+    std::atomic<bool> m_SwapChainRebuild { false };
 
 };
 
@@ -0,0 +1,44 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Runs a fixed schedule of named runs (each: warm-up frames, then measured frames), collects per-frame samples
+// into named series and writes min / mean / percentiles per run and series as JSON.
+class Benchmark {
+public:
+    Benchmark(std::string outputPath, std::vector<std::string> runNames, uint32_t warmupFrames, uint32_t measuredFrames);
+
+    // Describes the environment (GPU, driver, workload); written as the "info" object of the JSON.
+    void SetInfo(const std::string& key, const std::string& value);
+
+    void NextFrame();
+    void AddSample(const std::string& series, double value);
+    // For per-frame counts that are only reported when non-zero: every measured frame of the run the series was not
+    // given a sample for counts as 0, so its statistics always cover all measured frames.
+    void AddCountSample(const std::string& series, double value);
+    bool WriteJson() const;
+
+    uint32_t GetCurrentRun() const { return m_Frame / (m_WarmupFrames + m_MeasuredFrames); }
+    bool IsMeasuring() const { return !IsFinished() && m_Frame % (m_WarmupFrames + m_MeasuredFrames) >= m_WarmupFrames; }
+    bool IsFinished() const { return GetCurrentRun() >= m_RunNames.size(); }
+
+private:
+    std::string m_OutputPath;
+    std::vector<std::string> m_RunNames;
+    uint32_t m_WarmupFrames;
+    uint32_t m_MeasuredFrames;
+    uint32_t m_Frame = 0;
+
+    std::vector<std::pair<std::string, std::string>> m_Info;
+
+    std::vector<std::map<std::string, std::vector<double>>> m_Samples;
+    std::vector<std::set<std::string>> m_CountSeries;
+
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef DRAW_DATA_SNAPSHOT_HPP
+#define DRAW_DATA_SNAPSHOT_HPP
+
+#include <imgui.h>
+
+// Deep copy of an ImDrawData, so a frame built on the main thread can be rendered on another thread while ImGui
+// already works on the next one. Draw lists are reused between captures and their buffers only ever grow.
+class DrawDataSnapshot {
+public:
+    DrawDataSnapshot() = default;
+    ~DrawDataSnapshot();
+
+    DrawDataSnapshot(const DrawDataSnapshot&) = delete;
+    DrawDataSnapshot& operator=(const DrawDataSnapshot&) = delete;
+
+    void Capture(const ImDrawData* source);
+    ImDrawData* Get() { return &m_DrawData; }
+
+private:
+    ImDrawData m_DrawData;
+    ImVector<ImDrawList*> m_DrawLists;
+
+};
+
+#endif
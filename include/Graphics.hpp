@@ -6,8 +6,17 @@
 #include <imgui_impl_sdl2.h>
 #include <imgui_impl_vulkan.h>
 #include <glm/glm.hpp>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
+#include <string>
 #include "Application.h"
+#include "Benchmark.hpp"
+#include "DrawDataSnapshot.hpp"
+#include "ImGuiRenderer.hpp"
+#include "TripleBuffer.hpp"
+#include "VulkanDispatch.hpp"
 
 class Application;
 
@@ -23,21 +32,50 @@ public:
     void InitImGui();
     void Cleanup();
 
+    // Main thread, while the render thread is held off: the ImGui_ImplVulkanH_* helpers allocate through ImGui.
     void RebuildSwapChain(const int& width, const int& height);
-    void Draw();
+    // Render thread: only raw Vulkan calls, the in-tree renderer and ImGui_ImplVulkan_RenderDrawData.
+    bool RenderFrame();
+
+    // Main thread only: runs one UI tick and publishes its draw data as an immutable snapshot.
+    void BuildFrame();
+
+    void StartBenchmark(const std::string& outputPath, const int& widgetCount);
+    bool IsBenchmarkFinished() const { return m_BenchmarkFinished.load(std::memory_order_acquire); }
 
     static void CheckVkResult(VkResult err);
 
 private:
+    enum class ImGuiBackend : int {
+        Stock = 0,
+        InTree = 1
+    };
+
+    struct FrameSnapshot {
+        DrawDataSnapshot DrawData;
+        ImGuiBackend Backend = ImGuiBackend::InTree;
+    };
+
+    struct RenderStats {
+        float CpuTimeMs[2] = { 0.0f, 0.0f };
+        float FrameTimeMs = 0.0f; // moving average of the interval between presented frames
+        ImGuiRenderer::Stats InTree {};
+        VulkanCallStats VkCalls[VulkanDispatch::EntryCount] {};
+    };
+
     void Init(const char** extensions, uint32_t extensionCount);
     void SetupVulkanWindow(ImGui_ImplVulkanH_Window* wd, VkSurfaceKHR surface, const int& width, const int& height);
     void CleanupVulkanWindow();
     void CleanupVulkan();
 
-    void FrameRender(ImDrawData* drawData);
+    bool FrameRender(ImDrawData* drawData, ImGuiBackend backend);
     void FramePresent();
 
+    void DrawRendererWindow();
+    void DrawDashboard();
+
     Application*              m_Application;
+    VulkanDispatch            m_Vk;
     VkAllocationCallbacks*    m_Allocator = nullptr;
     VkInstance                m_Instance = VK_NULL_HANDLE;
     VkPhysicalDevice          m_PhysicalDevice = VK_NULL_HANDLE;
@@ -48,12 +86,29 @@ private:
     VkPipelineCache           m_PipelineCache = VK_NULL_HANDLE;
     VkDescriptorPool          m_DescriptorPool = VK_NULL_HANDLE;
     ImGui_ImplVulkanH_Window  m_MainWindowData {};
+    ImGuiRenderer             m_ImGuiRenderer;
 
     uint32_t m_MinImageCount = 2;
 
     bool m_showDemoWidow = true;
     glm::vec4 clearColor = { 0.45f, 0.55f, 0.60f, 1.0f };
 
+    // The stock backend stays initialized so both can be compared at runtime and by the benchmark.
+    ImGuiBackend m_ImGuiBackend = ImGuiBackend::InTree;
+    ImTextureID m_StockFontTexture = nullptr;
+    int m_DashboardWidgetCount = 0;
+
+    // Main thread -> render thread frames, render thread -> main thread statistics for the "Renderer" window
+    TripleBuffer<FrameSnapshot> m_Frames;
+    TripleBuffer<RenderStats> m_RenderStats;
+    RenderStats m_RenderStatsAccumulator {};
+    std::chrono::steady_clock::time_point m_LastPresentTime {};
+
+    // The benchmark itself is driven by the render thread; the main thread only follows the current run.
+    std::unique_ptr<Benchmark> m_Benchmark = nullptr;
+    std::atomic<int> m_BenchmarkRun { -1 };
+    std::atomic<bool> m_BenchmarkFinished { false };
+
 };
 
 #endif
@@ -0,0 +1,96 @@
+#ifndef IMGUI_RENDERER_HPP
+#define IMGUI_RENDERER_HPP
+
+#include <vulkan/vulkan.h>
+#include <imgui.h>
+#include <cstdint>
+#include <vector>
+#include "VulkanDispatch.hpp"
+
+// In-tree replacement for ImGui_ImplVulkan_RenderDrawData.
+// Geometry lives in grow-only, persistently mapped buffers (one set per frame in flight) and every ImDrawList is
+// copied in a single pass. Descriptor sets and scissors are only re-bound on change; within a draw list, adjacent
+// commands that end up with the same texture, scissor and vertex offset are drawn with one call.
+class ImGuiRenderer {
+public:
+    struct InitInfo {
+        const VulkanDispatch*         Dispatch = nullptr;
+        VkPhysicalDevice              PhysicalDevice = VK_NULL_HANDLE;
+        VkDevice                      Device = VK_NULL_HANDLE;
+        VkRenderPass                  RenderPass = VK_NULL_HANDLE;
+        VkPipelineCache               PipelineCache = VK_NULL_HANDLE;
+        VkDescriptorPool              DescriptorPool = VK_NULL_HANDLE;
+        uint32_t                      FrameCount = 2;
+        const VkAllocationCallbacks*  Allocator = nullptr;
+    };
+
+    struct Stats {
+        uint32_t DrawCalls = 0;
+        uint32_t MergedCommands = 0;
+        uint32_t DescriptorBinds = 0;
+        uint32_t ScissorUpdates = 0;
+    };
+
+    ImGuiRenderer() = default;
+    ~ImGuiRenderer();
+
+    ImGuiRenderer(const ImGuiRenderer&) = delete;
+    ImGuiRenderer& operator=(const ImGuiRenderer&) = delete;
+
+    void Init(const InitInfo& info);
+    void Shutdown();
+
+    void CreateFontsTexture(VkCommandBuffer commandBuffer);
+    void DestroyFontUploadObjects();
+    ImTextureID GetFontTextureID() const { return (ImTextureID) m_FontDescriptorSet; }
+
+    // Must only be called while the device is idle (e.g. right after the swap chain has been rebuilt).
+    void SetFrameCount(uint32_t frameCount);
+
+    // frameIndex selects the geometry buffers; the caller guarantees that frame's fence has been waited on.
+    void RenderDrawData(ImDrawData* drawData, VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    struct GeometryBuffer {
+        VkBuffer        Buffer = VK_NULL_HANDLE;
+        VkDeviceMemory  Memory = VK_NULL_HANDLE;
+        VkDeviceSize    Size = 0;
+        void*           Mapped = nullptr;
+    };
+
+    struct FrameGeometry {
+        GeometryBuffer Vertices;
+        GeometryBuffer Indices;
+    };
+
+    void CreateDeviceObjects();
+    void DestroyDeviceObjects();
+    void EnsureCapacity(GeometryBuffer& buffer, VkDeviceSize size, VkBufferUsageFlags usage);
+    void DestroyBuffer(GeometryBuffer& buffer);
+    void SetupRenderState(ImDrawData* drawData, VkCommandBuffer commandBuffer, FrameGeometry& frame, int fbWidth, int fbHeight);
+    uint32_t FindMemoryType(VkMemoryPropertyFlags properties, uint32_t typeBits) const;
+
+    InitInfo m_Info {};
+    const VulkanDispatch* m_Vk = nullptr;
+    VkDeviceSize m_BufferMemoryAlignment = 256;
+
+    VkSampler               m_FontSampler = VK_NULL_HANDLE;
+    VkDescriptorSetLayout   m_DescriptorSetLayout = VK_NULL_HANDLE;
+    VkPipelineLayout        m_PipelineLayout = VK_NULL_HANDLE;
+    VkPipeline              m_Pipeline = VK_NULL_HANDLE;
+
+    VkDeviceMemory          m_FontMemory = VK_NULL_HANDLE;
+    VkImage                 m_FontImage = VK_NULL_HANDLE;
+    VkImageView             m_FontView = VK_NULL_HANDLE;
+    VkDescriptorSet         m_FontDescriptorSet = VK_NULL_HANDLE;
+    VkDeviceMemory          m_UploadBufferMemory = VK_NULL_HANDLE;
+    VkBuffer                m_UploadBuffer = VK_NULL_HANDLE;
+
+    std::vector<FrameGeometry> m_Frames;
+    Stats m_Stats {};
+
+};
+
+#endif
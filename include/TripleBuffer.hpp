@@ -0,0 +1,46 @@
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single-producer / single-consumer triple buffer.
+// The producer always owns one slot and the consumer another; the third slot is exchanged atomically, so the producer
+// never waits and the consumer always sees the most recently published value (intermediate ones are dropped).
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Producer side
+    T& GetWriteBuffer() { return m_Buffers[m_WriteIndex]; }
+    void Publish() {
+        const uint8_t previous = m_Shared.exchange(static_cast<uint8_t>(m_WriteIndex | s_FreshBit), std::memory_order_acq_rel);
+        m_WriteIndex = previous & s_IndexMask;
+    }
+
+    // Consumer side: returns false (and keeps the current read slot) when nothing new has been published.
+    bool Acquire() {
+        if ((m_Shared.load(std::memory_order_relaxed) & s_FreshBit) == 0) {
+            return false;
+        }
+        const uint8_t previous = m_Shared.exchange(m_ReadIndex, std::memory_order_acq_rel);
+        m_ReadIndex = previous & s_IndexMask;
+        return true;
+    }
+    T& GetReadBuffer() { return m_Buffers[m_ReadIndex]; }
+
+private:
+    static constexpr uint8_t s_IndexMask = 0x3;
+    static constexpr uint8_t s_FreshBit = 0x4;
+
+    T m_Buffers[3];
+    uint8_t m_WriteIndex = 0;
+    uint8_t m_ReadIndex = 1;
+    std::atomic<uint8_t> m_Shared { 2 };
+
+};
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef VULKAN_DISPATCH_HPP
+#define VULKAN_DISPATCH_HPP
+
+#include <vulkan/vulkan.h>
+#include <chrono>
+#include <cstdint>
+
+// Entry points we call ourselves. Instance / device level functions are fetched with vkGetInstanceProcAddr /
+// vkGetDeviceProcAddr (like volk), so device calls go straight to the driver instead of through the loader trampolines.
+#define VK_DISPATCH_GLOBAL_FUNCTIONS(X) \
+    X(vkCreateInstance)
+
+#define VK_DISPATCH_INSTANCE_FUNCTIONS(X) \
+    X(vkDestroyInstance) \
+    X(vkEnumeratePhysicalDevices) \
+    X(vkGetPhysicalDeviceProperties) \
+    X(vkGetPhysicalDeviceQueueFamilyProperties) \
+    X(vkGetPhysicalDeviceMemoryProperties) \
+    X(vkGetPhysicalDeviceSurfaceSupportKHR) \
+    X(vkCreateDevice) \
+    X(vkCreateDebugReportCallbackEXT) \
+    X(vkDestroyDebugReportCallbackEXT)
+
+#define VK_DISPATCH_DEVICE_FUNCTIONS(X) \
+    X(vkDestroyDevice) \
+    X(vkGetDeviceQueue) \
+    X(vkDeviceWaitIdle) \
+    X(vkQueueSubmit) \
+    X(vkQueuePresentKHR) \
+    X(vkAcquireNextImageKHR) \
+    X(vkWaitForFences) \
+    X(vkResetFences) \
+    X(vkResetCommandPool) \
+    X(vkBeginCommandBuffer) \
+    X(vkEndCommandBuffer) \
+    X(vkCmdBeginRenderPass) \
+    X(vkCmdEndRenderPass) \
+    X(vkCmdBindPipeline) \
+    X(vkCmdBindDescriptorSets) \
+    X(vkCmdBindVertexBuffers) \
+    X(vkCmdBindIndexBuffer) \
+    X(vkCmdPushConstants) \
+    X(vkCmdSetViewport) \
+    X(vkCmdSetScissor) \
+    X(vkCmdDrawIndexed) \
+    X(vkCmdPipelineBarrier) \
+    X(vkCmdCopyBufferToImage) \
+    X(vkCreateDescriptorPool) \
+    X(vkDestroyDescriptorPool) \
+    X(vkAllocateDescriptorSets) \
+    X(vkFreeDescriptorSets) \
+    X(vkUpdateDescriptorSets) \
+    X(vkCreateDescriptorSetLayout) \
+    X(vkDestroyDescriptorSetLayout) \
+    X(vkCreatePipelineLayout) \
+    X(vkDestroyPipelineLayout) \
+    X(vkCreateShaderModule) \
+    X(vkDestroyShaderModule) \
+    X(vkCreateGraphicsPipelines) \
+    X(vkDestroyPipeline) \
+    X(vkCreateSampler) \
+    X(vkDestroySampler) \
+    X(vkCreateImage) \
+    X(vkDestroyImage) \
+    X(vkCreateImageView) \
+    X(vkDestroyImageView) \
+    X(vkGetImageMemoryRequirements) \
+    X(vkBindImageMemory) \
+    X(vkCreateBuffer) \
+    X(vkDestroyBuffer) \
+    X(vkGetBufferMemoryRequirements) \
+    X(vkBindBufferMemory) \
+    X(vkAllocateMemory) \
+    X(vkFreeMemory) \
+    X(vkMapMemory) \
+    X(vkUnmapMemory)
+
+#define VK_DISPATCH_ALL_FUNCTIONS(X) \
+    VK_DISPATCH_GLOBAL_FUNCTIONS(X) \
+    VK_DISPATCH_INSTANCE_FUNCTIONS(X) \
+    VK_DISPATCH_DEVICE_FUNCTIONS(X)
+
+struct VulkanCallStats {
+    uint32_t Calls = 0;
+    uint64_t Nanoseconds = 0;
+};
+
+#ifdef VK_DISPATCH_INSTRUMENTATION
+// Drop-in replacement for a PFN_vk* that counts and times every call (enabled with -DVULKAN_EXAMPLE_INSTRUMENT_VK=ON).
+template<typename PFN>
+class InstrumentedFunction;
+
+template<typename R, typename... Args>
+class InstrumentedFunction<R (VKAPI_PTR*)(Args...)> {
+public:
+    using Pointer = R (VKAPI_PTR*)(Args...);
+
+    void Bind(Pointer function, VulkanCallStats* stats) {
+        m_Function = function;
+        m_Stats = stats;
+    }
+    explicit operator bool() const { return m_Function != nullptr; }
+
+    R operator()(Args... args) const {
+        const Timer timer(*m_Stats);
+        return m_Function(args...);
+    }
+
+private:
+    struct Timer {
+        explicit Timer(VulkanCallStats& stats) : Stats(stats), Start(std::chrono::steady_clock::now()) {}
+        ~Timer() {
+            Stats.Calls++;
+            Stats.Nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count();
+        }
+        VulkanCallStats& Stats;
+        std::chrono::steady_clock::time_point Start;
+    };
+
+    Pointer m_Function = nullptr;
+    VulkanCallStats* m_Stats = nullptr;
+};
+
+template<typename PFN>
+using VulkanFunction = InstrumentedFunction<PFN>;
+#else
+template<typename PFN>
+using VulkanFunction = PFN;
+#endif
+
+class VulkanDispatch {
+public:
+    enum Entry : uint32_t {
+#define VK_DISPATCH_ENTRY(name) Entry_##name,
+        VK_DISPATCH_ALL_FUNCTIONS(VK_DISPATCH_ENTRY)
+#undef VK_DISPATCH_ENTRY
+        EntryCount
+    };
+
+#ifdef VK_DISPATCH_INSTRUMENTATION
+    static constexpr bool IsInstrumented = true;
+#else
+    static constexpr bool IsInstrumented = false;
+#endif
+
+    VulkanDispatch() = default;
+
+    // Instrumented entries point into m_Stats, so a copy would keep counting into the original
+    VulkanDispatch(const VulkanDispatch&) = delete;
+    VulkanDispatch& operator=(const VulkanDispatch&) = delete;
+    VulkanDispatch(VulkanDispatch&&) = delete;
+    VulkanDispatch& operator=(VulkanDispatch&&) = delete;
+
+    static const char* GetEntryName(uint32_t entry);
+
+    void LoadGlobal();
+    void LoadInstance(VkInstance instance);
+    void LoadDevice(VkDevice device);
+
+    // Hands out the counters gathered since the previous call and starts counting the next frame.
+    // Without instrumentation all counters stay zero.
+    void CollectFrameStats(VulkanCallStats (&stats)[EntryCount]);
+
+#define VK_DISPATCH_MEMBER(name) VulkanFunction<PFN_##name> name {};
+    VK_DISPATCH_ALL_FUNCTIONS(VK_DISPATCH_MEMBER)
+#undef VK_DISPATCH_MEMBER
+
+private:
+#ifdef VK_DISPATCH_INSTRUMENTATION
+    template<typename PFN>
+    void Bind(InstrumentedFunction<PFN>& function, PFN pointer, Entry entry) { function.Bind(pointer, &m_Stats[entry]); }
+#else
+    template<typename PFN>
+    void Bind(PFN& function, PFN pointer, Entry) { function = pointer; }
+#endif
+
+    PFN_vkGetDeviceProcAddr m_GetDeviceProcAddr = nullptr;
+    VulkanCallStats m_Stats[EntryCount] {};
+
+};
+
+#endif
@@ -1,10 +1,18 @@
 #include "Application.h"
 
 #include <SDL_vulkan.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 #include "Error.hpp"
 #include "Log.hpp"
 
+// UI / simulation tick rate of the main thread, independent of how fast frames are presented.
+static constexpr double s_TickRate = 120.0;
+// How long the render thread backs off when there is no new frame yet (or a swap chain rebuild is pending).
+static constexpr std::chrono::microseconds s_RenderIdleSleep(500);
+
 Application::Application() {
     InitSDLWindow();
     InitVulkan();
@@ -76,8 +84,23 @@ void Application::InitVulkan() {
     m_graphics->InitImGui();
 }
 
+void Application::EnableBenchmark(const std::string& outputPath, const int& widgetCount) {
+    m_graphics->StartBenchmark(outputPath, widgetCount);
+}
+
 void Application::Run() {
+    m_renderThread = std::thread(&Application::RenderLoop, this);
+
+    const auto tickDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / s_TickRate));
+    auto nextTick = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point lastTick {};
+    m_tickStats.TargetMs = static_cast<float>(1000.0 / s_TickRate);
     while (!m_shouldClose) {
+        const auto tickStart = std::chrono::steady_clock::now();
+        if (lastTick != std::chrono::steady_clock::time_point {}) {
+            UpdateTickStats(tickStart - lastTick);
+        }
+        lastTick = tickStart;
 
         // Event Handling
         SDL_Event event;
@@ -100,19 +123,80 @@ void Application::Run() {
             }
         }
 
-        // Resize Swap Chain
-        if (m_SwapChainRebuild) {
-            int width, height;
-            SDL_GetWindowSize(m_window.handler, &width, &height);
-            if (width > 0 && height > 0) {
-                m_graphics->RebuildSwapChain(width, height);
-                m_SwapChainRebuild = false;
-            }
+        RebuildSwapChainIfRequested();
+
+        m_graphics->BuildFrame();
+        if (m_graphics->IsBenchmarkFinished()) {
+            m_shouldClose = true;
         }
 
-        m_graphics->Draw();
+        // Fixed tick; when we fall behind, skip ahead instead of running a burst of catch-up ticks
+        nextTick += tickDuration;
+        const auto now = std::chrono::steady_clock::now();
+        if (nextTick < now) {
+            nextTick = now;
+        }
+        std::this_thread::sleep_until(nextTick);
     }
 
     // Cleanup
+    m_renderThreadStop.store(true, std::memory_order_release);
+    m_renderThread.join();
     m_graphics->Cleanup();
+}
+
+void Application::RenderLoop() {
+    while (!m_renderThreadStop.load(std::memory_order_acquire)) {
+        // The swap chain is out of date, wait for the main thread to rebuild it
+        if (m_SwapChainRebuild.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(s_RenderIdleSleep);
+            continue;
+        }
+
+        bool rendered;
+        {
+            std::lock_guard<std::mutex> lock(m_renderMutex);
+            rendered = m_graphics->RenderFrame();
+        }
+        if (!rendered) {
+            std::this_thread::sleep_for(s_RenderIdleSleep);
+        }
+    }
+}
+
+// The ImGui_ImplVulkanH_* helpers and ImGui_ImplVulkan_SetMinImageCount allocate through the ImGui context, so the
+// rebuild runs on the main thread, with the render thread held off by m_renderMutex.
+void Application::RebuildSwapChainIfRequested() {
+    if (!m_SwapChainRebuild.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    // Minimized: keep the request pending until the window has a usable size again
+    int width, height;
+    SDL_GetWindowSize(m_window.handler, &width, &height);
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_renderMutex);
+    m_graphics->RebuildSwapChain(width, height);
+    m_SwapChainRebuild.store(false, std::memory_order_release);
+}
+
+void Application::UpdateTickStats(std::chrono::steady_clock::duration interval) {
+    const float intervalMs = std::chrono::duration<float, std::milli>(interval).count();
+    if (intervalMs <= 0.0f) {
+        return;
+    }
+    const float jitterMs = std::abs(intervalMs - m_tickStats.TargetMs);
+    float& average = m_tickStats.JitterMs;
+    average = average == 0.0f ? jitterMs : average * 0.95f + jitterMs * 0.05f;
+
+    // The peak is published once per second so a single hiccup stays readable
+    m_tickJitterPeak = std::max(m_tickJitterPeak, jitterMs);
+    if (++m_tickJitterWindow >= static_cast<uint32_t>(s_TickRate)) {
+        m_tickStats.MaxJitterMs = m_tickJitterPeak;
+        m_tickJitterPeak = 0.0f;
+        m_tickJitterWindow = 0;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include "Log.hpp"
+
+static std::string EscapeJson(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        if (static_cast<unsigned char>(c) >= 0x20) {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+Benchmark::Benchmark(std::string outputPath, std::vector<std::string> runNames, uint32_t warmupFrames, uint32_t measuredFrames)
+    : m_OutputPath(std::move(outputPath)),
+      m_RunNames(std::move(runNames)),
+      m_WarmupFrames(warmupFrames),
+      m_MeasuredFrames(measuredFrames),
+      m_Samples(m_RunNames.size()),
+      m_CountSeries(m_RunNames.size()) {
+}
+
+void Benchmark::SetInfo(const std::string& key, const std::string& value) {
+    m_Info.emplace_back(key, value);
+}
+
+void Benchmark::NextFrame() {
+    if (!IsFinished()) {
+        m_Frame++;
+    }
+}
+
+void Benchmark::AddSample(const std::string& series, double value) {
+    if (!IsMeasuring()) {
+        return;
+    }
+
+    auto& samples = m_Samples[GetCurrentRun()][series];
+    if (samples.empty()) {
+        samples.reserve(m_MeasuredFrames);
+    }
+    samples.push_back(value);
+}
+
+void Benchmark::AddCountSample(const std::string& series, double value) {
+    if (!IsMeasuring()) {
+        return;
+    }
+
+    const uint32_t run = GetCurrentRun();
+    const uint32_t measuredFrame = m_Frame % (m_WarmupFrames + m_MeasuredFrames) - m_WarmupFrames;
+    auto& samples = m_Samples[run][series];
+    if (samples.empty()) {
+        samples.reserve(m_MeasuredFrames);
+        m_CountSeries[run].insert(series);
+    }
+    samples.resize(measuredFrame, 0.0);
+    samples.push_back(value);
+}
+
+bool Benchmark::WriteJson() const {
+    std::ofstream out(m_OutputPath);
+    if (!out) {
+        Log::Message("Failed to open benchmark output file: %s", m_OutputPath.c_str());
+        return false;
+    }
+
+    out << "{\n";
+    out << "  \"info\": {";
+    for (size_t i = 0; i < m_Info.size(); i++) {
+        out << (i == 0 ? " " : ", ") << "\"" << EscapeJson(m_Info[i].first) << "\": \"" << EscapeJson(m_Info[i].second) << "\"";
+    }
+    out << (m_Info.empty() ? "},\n" : " },\n");
+    out << "  \"warmup_frames\": " << m_WarmupFrames << ",\n";
+    out << "  \"measured_frames\": " << m_MeasuredFrames << ",\n";
+    out << "  \"runs\": {";
+    for (size_t run = 0; run < m_RunNames.size(); run++) {
+        out << (run == 0 ? "\n" : ",\n") << "    \"" << m_RunNames[run] << "\": {";
+        bool firstSeries = true;
+        for (const auto& [name, values] : m_Samples[run]) {
+            std::vector<double> sorted = values;
+            if (m_CountSeries[run].count(name) > 0) {
+                // Frames after the last reported one
+                sorted.resize(m_MeasuredFrames, 0.0);
+            }
+            std::sort(sorted.begin(), sorted.end());
+            const auto percentile = [&sorted](double p) {
+                return sorted[static_cast<size_t>(p * static_cast<double>(sorted.size() - 1))];
+            };
+            const double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size());
+
+            out << (firstSeries ? "\n" : ",\n") << "      \"" << name << "\": { "
+                << "\"count\": " << sorted.size() << ", "
+                << "\"mean\": " << mean << ", "
+                << "\"min\": " << sorted.front() << ", "
+                << "\"p50\": " << percentile(0.50) << ", "
+                << "\"p99\": " << percentile(0.99) << ", "
+                << "\"max\": " << sorted.back() << " }";
+            firstSeries = false;
+        }
+        out << (firstSeries ? "}" : "\n    }");
+    }
+    out << "\n  }\n}\n";
+
+    Log::Message("Benchmark results written to %s", m_OutputPath.c_str());
+    return true;
+}
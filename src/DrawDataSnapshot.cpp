@@ -0,0 +1,57 @@
+#include "DrawDataSnapshot.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+template<typename T>
+static void CopyVector(ImVector<T>& destination, const ImVector<T>& source) {
+    // ImVector::operator= frees and reallocates, resize() keeps the existing capacity
+    destination.resize(source.Size);
+    if (source.Size > 0) {
+        memcpy(destination.Data, source.Data, source.size_in_bytes());
+    }
+}
+
+// ImDrawData::CmdLists is a raw array before Dear ImGui 1.89.8 and an ImVector since then
+template<typename DrawLists>
+static void AssignDrawLists(DrawLists& destination, ImVector<ImDrawList*>& lists, int count) {
+    if constexpr (std::is_pointer<DrawLists>::value) {
+        destination = lists.Data;
+    } else {
+        destination.resize(count);
+        for (int n = 0; n < count; n++) {
+            destination[n] = lists[n];
+        }
+    }
+}
+
+DrawDataSnapshot::~DrawDataSnapshot() {
+    for (ImDrawList* drawList : m_DrawLists) {
+        IM_DELETE(drawList);
+    }
+}
+
+void DrawDataSnapshot::Capture(const ImDrawData* source) {
+    const int count = source->CmdListsCount;
+    while (m_DrawLists.Size < count) {
+        m_DrawLists.push_back(IM_NEW(ImDrawList)(nullptr));
+    }
+
+    for (int n = 0; n < count; n++) {
+        const ImDrawList* src = source->CmdLists[n];
+        ImDrawList* dst = m_DrawLists[n];
+        CopyVector(dst->CmdBuffer, src->CmdBuffer);
+        CopyVector(dst->IdxBuffer, src->IdxBuffer);
+        CopyVector(dst->VtxBuffer, src->VtxBuffer);
+        dst->Flags = src->Flags;
+    }
+
+    m_DrawData.Valid = source->Valid;
+    m_DrawData.CmdListsCount = count;
+    m_DrawData.TotalIdxCount = source->TotalIdxCount;
+    m_DrawData.TotalVtxCount = source->TotalVtxCount;
+    m_DrawData.DisplayPos = source->DisplayPos;
+    m_DrawData.DisplaySize = source->DisplaySize;
+    m_DrawData.FramebufferScale = source->FramebufferScale;
+    AssignDrawLists(m_DrawData.CmdLists, m_DrawLists, count);
+}
@@ -1,6 +1,10 @@
 #include "Graphics.hpp"
 
 #include <imgui.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 #include "Error.hpp"
 #include "Log.hpp"
 
@@ -23,6 +27,10 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL DebugReport(VkDebugReportFlagsEXT flags,
 }
 #endif
 
+// Benchmark schedule: every backend renders the same dashboard for warm-up + measured frames.
+static constexpr uint32_t s_BenchmarkWarmupFrames = 120;
+static constexpr uint32_t s_BenchmarkMeasuredFrames = 1000;
+
 Graphics::Graphics(Application* app, const char **extensions, uint32_t extensionCount) : m_Application(app) {
     Init(extensions, extensionCount);
 }
@@ -66,6 +74,17 @@ void Graphics::InitImGui() {
     initInfo.CheckVkResultFn = Graphics::CheckVkResult;
     ImGui_ImplVulkan_Init(&initInfo, wd->RenderPass);
 
+    ImGuiRenderer::InitInfo rendererInfo;
+    rendererInfo.Dispatch = &m_Vk;
+    rendererInfo.PhysicalDevice = m_PhysicalDevice;
+    rendererInfo.Device = m_Device;
+    rendererInfo.RenderPass = wd->RenderPass;
+    rendererInfo.PipelineCache = m_PipelineCache;
+    rendererInfo.DescriptorPool = m_DescriptorPool;
+    rendererInfo.FrameCount = wd->ImageCount;
+    rendererInfo.Allocator = m_Allocator;
+    m_ImGuiRenderer.Init(rendererInfo);
+
     // Load font
     ImFont* font = io.Fonts->AddFontFromFileTTF("assets\\fonts\\Fantasque Sans Mono Nerd Font.ttf", 16.0f);
     IM_ASSERT(font != nullptr);
@@ -76,49 +95,98 @@ void Graphics::InitImGui() {
         VkCommandPool commandPool = wd->Frames[wd->FrameIndex].CommandPool;
         VkCommandBuffer commandBuffer = wd->Frames[wd->FrameIndex].CommandBuffer;
 
-        err = vkResetCommandPool(m_Device, commandPool, 0);
+        err = m_Vk.vkResetCommandPool(m_Device, commandPool, 0);
         CheckVkResult(err);
         VkCommandBufferBeginInfo beginInfo = {};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.flags != VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        err = vkBeginCommandBuffer(commandBuffer, &beginInfo);
+        err = m_Vk.vkBeginCommandBuffer(commandBuffer, &beginInfo);
         CheckVkResult(err);
 
         ImGui_ImplVulkan_CreateFontsTexture(commandBuffer);
+        m_StockFontTexture = io.Fonts->TexID;
+        m_ImGuiRenderer.CreateFontsTexture(commandBuffer);
+
+        // ImGui_ImplVulkan_RenderDrawData allocates its per-frame buffer array (IM_ALLOC) on first use. Do that here,
+        // before the render thread exists; an empty frame only records pipeline / viewport state and no draws.
+        ImDrawData primer;
+        primer.Valid = true;
+        primer.DisplaySize = ImVec2(1.0f, 1.0f);
+        primer.FramebufferScale = ImVec2(1.0f, 1.0f);
+        ImGui_ImplVulkan_RenderDrawData(&primer, commandBuffer);
 
         VkSubmitInfo endInfo = {};
         endInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         endInfo.commandBufferCount = 1;
         endInfo.pCommandBuffers = &commandBuffer;
-        err = vkEndCommandBuffer(commandBuffer);
+        err = m_Vk.vkEndCommandBuffer(commandBuffer);
         CheckVkResult(err);
-        err = vkQueueSubmit(m_Queue, 1, &endInfo, VK_NULL_HANDLE);
+        err = m_Vk.vkQueueSubmit(m_Queue, 1, &endInfo, VK_NULL_HANDLE);
         CheckVkResult(err);
 
-        err = vkDeviceWaitIdle(m_Device);
+        err = m_Vk.vkDeviceWaitIdle(m_Device);
         CheckVkResult(err);
         ImGui_ImplVulkan_DestroyFontUploadObjects();
+        m_ImGuiRenderer.DestroyFontUploadObjects();
     }
 }
 
 void Graphics::Cleanup() {
     VkResult err;
-    err = vkDeviceWaitIdle(m_Device);
+    err = m_Vk.vkDeviceWaitIdle(m_Device);
     CheckVkResult(err);
 
+    m_ImGuiRenderer.Shutdown();
     ImGui_ImplVulkan_Shutdown();
     ImGui_ImplSDL2_Shutdown();
     ImGui::DestroyContext();
 }
 
 void Graphics::RebuildSwapChain(const int& width, const int& height) {
+    // m_MinImageCount never changes, so this keeps the stock backend's buffers allocated in InitImGui
     ImGui_ImplVulkan_SetMinImageCount(m_MinImageCount);
     ImGui_ImplVulkanH_CreateOrResizeWindow(m_Instance, m_PhysicalDevice, m_Device, &m_MainWindowData, m_QueueFamily, m_Allocator, width, height, m_MinImageCount);
     m_MainWindowData.FrameIndex = 0;
+    m_ImGuiRenderer.SetFrameCount(m_MainWindowData.ImageCount);
 }
 
-void Graphics::Draw() {
-    ImGui_ImplVulkanH_Window* wd = &m_MainWindowData;
+void Graphics::StartBenchmark(const std::string& outputPath, const int& widgetCount) {
+    m_Benchmark = std::make_unique<Benchmark>(outputPath,
+                                              std::vector<std::string> { "stock", "in_tree" },
+                                              s_BenchmarkWarmupFrames,
+                                              s_BenchmarkMeasuredFrames);
+    m_DashboardWidgetCount = widgetCount;
+    m_BenchmarkRun.store(0, std::memory_order_relaxed);
+
+    // Results are only comparable on the same GPU / driver, so record them with the numbers
+    VkPhysicalDeviceProperties properties;
+    m_Vk.vkGetPhysicalDeviceProperties(m_PhysicalDevice, &properties);
+    char version[64];
+    const uint32_t driver = properties.driverVersion;
+    if (properties.vendorID == 0x10DE) {
+        // NVIDIA packs the driver version as 10.8.8.6 bits
+        snprintf(version, sizeof(version), "%u.%u.%u.%u", driver >> 22, (driver >> 14) & 0xff, (driver >> 6) & 0xff, driver & 0x3f);
+    } else {
+        snprintf(version, sizeof(version), "%u.%u.%u", VK_VERSION_MAJOR(driver), VK_VERSION_MINOR(driver), VK_VERSION_PATCH(driver));
+    }
+    m_Benchmark->SetInfo("gpu", properties.deviceName);
+    m_Benchmark->SetInfo("driver_version", version);
+    m_Benchmark->SetInfo("api_version", std::to_string(VK_VERSION_MAJOR(properties.apiVersion)) + "." +
+                                        std::to_string(VK_VERSION_MINOR(properties.apiVersion)) + "." +
+                                        std::to_string(VK_VERSION_PATCH(properties.apiVersion)));
+    m_Benchmark->SetInfo("dashboard_widgets", std::to_string(widgetCount));
+    m_Benchmark->SetInfo("vk_instrumentation", VulkanDispatch::IsInstrumented ? "on" : "off");
+    Log::Message("Benchmark started: %d dashboard widgets, %u frames per backend.", widgetCount, s_BenchmarkMeasuredFrames);
+}
+
+void Graphics::BuildFrame() {
+    const int benchmarkRun = m_BenchmarkRun.load(std::memory_order_relaxed);
+    if (benchmarkRun >= 0) {
+        m_ImGuiBackend = static_cast<ImGuiBackend>(benchmarkRun);
+    }
+
+    // The font texture id is baked into the draw lists, so it has to match the backend before the frame starts
+    ImGui::GetIO().Fonts->SetTexID(m_ImGuiBackend == ImGuiBackend::Stock ? m_StockFontTexture : m_ImGuiRenderer.GetFontTextureID());
 
     // Start the Dear ImGui frame
     ImGui_ImplVulkan_NewFrame();
@@ -127,25 +195,192 @@ void Graphics::Draw() {
     if (m_showDemoWidow) {
         ImGui::ShowDemoWindow();
     }
+    DrawRendererWindow();
+    if (m_DashboardWidgetCount > 0) {
+        DrawDashboard();
+    }
 
-    // Rendering
+    // Hand the frame over to the render thread
     ImGui::Render();
-    ImDrawData* drawData = ImGui::GetDrawData();
+    FrameSnapshot& snapshot = m_Frames.GetWriteBuffer();
+    snapshot.DrawData.Capture(ImGui::GetDrawData());
+    snapshot.Backend = m_ImGuiBackend;
+    m_Frames.Publish();
+}
+
+bool Graphics::RenderFrame() {
+    ImGui_ImplVulkanH_Window* wd = &m_MainWindowData;
+    if (!m_Frames.Acquire()) {
+        return false;
+    }
+
+    FrameSnapshot& snapshot = m_Frames.GetReadBuffer();
+    ImDrawData* drawData = snapshot.DrawData.Get();
     const bool isMinimized = (drawData->DisplaySize.x <= 0.0f || drawData->DisplaySize.y <= 0.0f);
+    bool presented = false;
     if (!isMinimized) {
         wd->ClearValue.color.float32[0] = clearColor.r * clearColor.a;
         wd->ClearValue.color.float32[1] = clearColor.g * clearColor.a;
         wd->ClearValue.color.float32[2] = clearColor.b * clearColor.a;
         wd->ClearValue.color.float32[3] = clearColor.a;
-        FrameRender(drawData);
-        FramePresent();
+        if (FrameRender(drawData, snapshot.Backend)) {
+            FramePresent();
+            presented = true;
+        }
+    }
+
+    // Frame time of the render thread; a gap without presents (minimized, swap chain rebuild) starts over
+    const auto now = std::chrono::steady_clock::now();
+    if (presented && m_LastPresentTime != std::chrono::steady_clock::time_point {}) {
+        const float frameTimeMs = std::chrono::duration<float, std::milli>(now - m_LastPresentTime).count();
+        float& average = m_RenderStatsAccumulator.FrameTimeMs;
+        average = average == 0.0f ? frameTimeMs : average * 0.95f + frameTimeMs * 0.05f;
+    }
+    m_LastPresentTime = presented ? now : std::chrono::steady_clock::time_point {};
+
+    // Everything issued through the dispatch table since the previous frame, swap chain rebuilds included
+    m_Vk.CollectFrameStats(m_RenderStatsAccumulator.VkCalls);
+    m_RenderStats.GetWriteBuffer() = m_RenderStatsAccumulator;
+    m_RenderStats.Publish();
+
+    // imgui_impl_vulkan calls through the loader rather than our table, so only the in-tree run has call counts
+    if (VulkanDispatch::IsInstrumented && m_Benchmark && snapshot.Backend == ImGuiBackend::InTree &&
+        static_cast<uint32_t>(snapshot.Backend) == m_Benchmark->GetCurrentRun()) {
+        uint32_t totalCalls = 0;
+        for (uint32_t entry = 0; entry < VulkanDispatch::EntryCount; entry++) {
+            const VulkanCallStats& calls = m_RenderStatsAccumulator.VkCalls[entry];
+            if (calls.Calls > 0) {
+                // Sporadic entries (buffer growth, rebuilds) count as 0 on every other measured frame
+                const std::string name = VulkanDispatch::GetEntryName(entry);
+                m_Benchmark->AddCountSample(name + ".calls", calls.Calls);
+                m_Benchmark->AddCountSample(name + ".us", static_cast<double>(calls.Nanoseconds) / 1000.0);
+                totalCalls += calls.Calls;
+            }
+        }
+        m_Benchmark->AddSample("vk_calls", totalCalls);
     }
+
+    if (m_Benchmark && !m_Benchmark->IsFinished()) {
+        m_Benchmark->NextFrame();
+        if (m_Benchmark->IsFinished()) {
+            m_Benchmark->WriteJson();
+            m_BenchmarkFinished.store(true, std::memory_order_release);
+        } else {
+            m_BenchmarkRun.store(static_cast<int>(m_Benchmark->GetCurrentRun()), std::memory_order_relaxed);
+        }
+    }
+    return true;
+}
+
+void Graphics::DrawRendererWindow() {
+    ImGui::Begin("Renderer");
+
+    int backend = static_cast<int>(m_ImGuiBackend);
+    ImGui::RadioButton("imgui_impl_vulkan", &backend, static_cast<int>(ImGuiBackend::Stock));
+    ImGui::SameLine();
+    ImGui::RadioButton("In-tree", &backend, static_cast<int>(ImGuiBackend::InTree));
+    if (!m_Benchmark) {
+        m_ImGuiBackend = static_cast<ImGuiBackend>(backend);
+    }
+    ImGui::SliderInt("Dashboard widgets", &m_DashboardWidgetCount, 0, 50000);
+
+    // Keeps showing the previous values when the render thread has not finished a frame since the last tick
+    m_RenderStats.Acquire();
+    const RenderStats& renderStats = m_RenderStats.GetReadBuffer();
+    ImGui::Separator();
+    ImGui::Text("CPU render time (imgui_impl_vulkan): %.3f ms", renderStats.CpuTimeMs[static_cast<int>(ImGuiBackend::Stock)]);
+    ImGui::Text("CPU render time (in-tree):           %.3f ms", renderStats.CpuTimeMs[static_cast<int>(ImGuiBackend::InTree)]);
+    if (m_ImGuiBackend == ImGuiBackend::InTree) {
+        const auto& stats = renderStats.InTree;
+        ImGui::Text("Draw calls: %u (merged commands: %u)", stats.DrawCalls, stats.MergedCommands);
+        ImGui::Text("Descriptor binds: %u, scissor updates: %u", stats.DescriptorBinds, stats.ScissorUpdates);
+    }
+    ImGui::Separator();
+    const float frameTimeMs = renderStats.FrameTimeMs;
+    ImGui::Text("Render thread: %.3f ms/frame (%.1f FPS)", frameTimeMs, frameTimeMs > 0.0f ? 1000.0f / frameTimeMs : 0.0f);
+    ImGui::Text("UI tick:       %.3f ms/tick (%.1f Hz)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+    const Application::TickStats& tick = m_Application->GetTickStats();
+    ImGui::Text("Tick jitter:   %.3f ms avg, %.3f ms max (target %.3f ms)", tick.JitterMs, tick.MaxJitterMs, tick.TargetMs);
+
+    if (ImGui::CollapsingHeader("Vulkan calls (last frame)")) {
+        if (!VulkanDispatch::IsInstrumented) {
+            ImGui::TextDisabled("Configure with -DVULKAN_EXAMPLE_INSTRUMENT_VK=ON to count calls.");
+        } else if (ImGui::BeginTable("VulkanCalls", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+            ImGui::TableSetupColumn("Entry point");
+            ImGui::TableSetupColumn("Calls");
+            ImGui::TableSetupColumn("Time (us)");
+            ImGui::TableHeadersRow();
+
+            uint32_t totalCalls = 0;
+            uint64_t totalNanoseconds = 0;
+            for (uint32_t entry = 0; entry < VulkanDispatch::EntryCount; entry++) {
+                const VulkanCallStats& calls = renderStats.VkCalls[entry];
+                if (calls.Calls == 0) {
+                    continue;
+                }
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(VulkanDispatch::GetEntryName(entry));
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", calls.Calls);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(calls.Nanoseconds) / 1000.0);
+                totalCalls += calls.Calls;
+                totalNanoseconds += calls.Nanoseconds;
+            }
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Total");
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", totalCalls);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", static_cast<double>(totalNanoseconds) / 1000.0);
+            ImGui::EndTable();
+        }
+        ImGui::TextDisabled("imgui_impl_vulkan and the ImGui_ImplVulkanH_* helpers still call through the loader.");
+    }
+
+    ImGui::End();
+}
+
+// Dense grid of small gauges, standing in for a dashboard with tens of thousands of widgets.
+void Graphics::DrawDashboard() {
+    ImGui::SetNextWindowSize(ImVec2(640.0f, 480.0f), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Dashboard")) {
+        ImGui::End();
+        return;
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const ImVec2 avail = ImGui::GetContentRegionAvail();
+    if (avail.x > 0.0f && avail.y > 0.0f) {
+        const int count = m_DashboardWidgetCount;
+        const int columns = std::max(1, static_cast<int>(std::ceil(std::sqrt(count * avail.x / avail.y))));
+        const int rows = (count + columns - 1) / columns;
+        const ImVec2 cell(avail.x / columns, avail.y / rows);
+        const auto time = static_cast<float>(ImGui::GetTime());
+
+        for (int i = 0; i < count; i++) {
+            const ImVec2 min(origin.x + (i % columns) * cell.x, origin.y + (i / columns) * cell.y);
+            const ImVec2 max(min.x + cell.x - 1.0f, min.y + cell.y - 1.0f);
+            const float value = 0.5f + 0.5f * std::sin(time * 2.0f + i * 0.37f);
+            drawList->AddRectFilled(min, max, IM_COL32(40, 40, 40, 255));
+            drawList->AddRectFilled(min, ImVec2(min.x + (max.x - min.x) * value, max.y), ImColor::HSV(value * 0.33f, 0.8f, 0.8f));
+        }
+        ImGui::Dummy(avail);
+    }
+
+    ImGui::End();
 }
 
 void Graphics::Init(const char **extensions, uint32_t extensionCount) {
     VkResult err;
     Log::Message("Vulkan Extension Count: %d extensions supports.", extensionCount);
 
+    // Load the global entry points of our dispatch table
+    m_Vk.LoadGlobal();
+
     // Create Vulkan Instance
     {
         VkInstanceCreateInfo createInfo {};
@@ -169,13 +404,13 @@ void Graphics::Init(const char **extensions, uint32_t extensionCount) {
         createInfo.ppEnabledLayerNames = extensionsEXT;
 
         // Create Vulkan Instance
-        err = vkCreateInstance(&createInfo, m_Allocator, &m_Instance);
+        err = m_Vk.vkCreateInstance(&createInfo, m_Allocator, &m_Instance);
         CheckVkResult(err);
+        m_Vk.LoadInstance(m_Instance);
         free(extensionsEXT);
 
-        // Get the function pointer (required for any extensions)
-        auto vkCreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) vkGetInstanceProcAddr(m_Instance, "vkCreateDebugReportCallbackEXT");
-        IM_ASSERT(vkCreateDebugReportCallbackEXT != nullptr);
+        // Extension entry points are loaded together with the instance table
+        IM_ASSERT(m_Vk.vkCreateDebugReportCallbackEXT);
 
         // Setup the debug report callback
         VkDebugReportCallbackCreateInfoEXT debugReportCI = {};
@@ -183,12 +418,13 @@ void Graphics::Init(const char **extensions, uint32_t extensionCount) {
         debugReportCI.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
         debugReportCI.pfnCallback = DebugReport;
         debugReportCI.pUserData = nullptr;
-        err = vkCreateDebugReportCallbackEXT(m_Instance, &debugReportCI, m_Allocator, &m_DebugReport);
+        err = m_Vk.vkCreateDebugReportCallbackEXT(m_Instance, &debugReportCI, m_Allocator, &m_DebugReport);
         CheckVkResult(err);
 #else
         // create Vulkan Instance without any debug feature.
-        err = vkCreateInstance(&createInfo, m_Allocator, &m_Instance);
+        err = m_Vk.vkCreateInstance(&createInfo, m_Allocator, &m_Instance);
         CheckVkResult(err);
+        m_Vk.LoadInstance(m_Instance);
         IM_UNUSED(m_DebugReport);
 #endif
     }
@@ -196,12 +432,12 @@ void Graphics::Init(const char **extensions, uint32_t extensionCount) {
     // Setup GPU
     {
         uint32_t gpuCount;
-        err = vkEnumeratePhysicalDevices(m_Instance, &gpuCount, nullptr);
+        err = m_Vk.vkEnumeratePhysicalDevices(m_Instance, &gpuCount, nullptr);
         CheckVkResult(err);
         IM_ASSERT(gpuCount > 0);
 
         auto* GPUs = (VkPhysicalDevice*) malloc(sizeof(VkPhysicalDevice) * gpuCount);
-        err = vkEnumeratePhysicalDevices(m_Instance, &gpuCount, GPUs);
+        err = m_Vk.vkEnumeratePhysicalDevices(m_Instance, &gpuCount, GPUs);
         CheckVkResult(err);
 
         // If a number > 1 of GPUs got reported, find discrete GPU if present, or use first one available.
@@ -210,7 +446,7 @@ void Graphics::Init(const char **extensions, uint32_t extensionCount) {
         int useGPU = 0;
         for (int i = 0; i < static_cast<int>(gpuCount); i++) {
             VkPhysicalDeviceProperties properties;
-            vkGetPhysicalDeviceProperties(GPUs[i], &properties);
+            m_Vk.vkGetPhysicalDeviceProperties(GPUs[i], &properties);
             if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU) {
                 useGPU = i;
                 break;
@@ -224,9 +460,9 @@ void Graphics::Init(const char **extensions, uint32_t extensionCount) {
     // Select graphics queue family
     {
         uint32_t count;
-        vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &count, nullptr);
+        m_Vk.vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &count, nullptr);
         auto* queues = (VkQueueFamilyProperties*) malloc(sizeof(VkQueueFamilyProperties) * count);
-        vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &count, queues);
+        m_Vk.vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &count, queues);
         for (uint32_t i = 0; i < count; i++) {
             if (queues[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
                 m_QueueFamily = i;
@@ -254,9 +490,10 @@ void Graphics::Init(const char **extensions, uint32_t extensionCount) {
         createInfo.pQueueCreateInfos = queueInfo;
         createInfo.enabledExtensionCount = deviceExtensionCount;
         createInfo.ppEnabledExtensionNames = deviceExtensions;
-        err = vkCreateDevice(m_PhysicalDevice, &createInfo, m_Allocator, &m_Device);
+        err = m_Vk.vkCreateDevice(m_PhysicalDevice, &createInfo, m_Allocator, &m_Device);
         CheckVkResult(err);
-        vkGetDeviceQueue(m_Device, m_QueueFamily, 0, &m_Queue);
+        m_Vk.LoadDevice(m_Device);
+        m_Vk.vkGetDeviceQueue(m_Device, m_QueueFamily, 0, &m_Queue);
     }
 
     // Create Descriptor Pool
@@ -280,7 +517,7 @@ void Graphics::Init(const char **extensions, uint32_t extensionCount) {
         poolInfo.maxSets = 1000 * IM_ARRAYSIZE(poolSizes);
         poolInfo.poolSizeCount = (uint32_t)IM_ARRAYSIZE(poolSizes);
         poolInfo.pPoolSizes = poolSizes;
-        err = vkCreateDescriptorPool(m_Device, &poolInfo, m_Allocator, &m_DescriptorPool);
+        err = m_Vk.vkCreateDescriptorPool(m_Device, &poolInfo, m_Allocator, &m_DescriptorPool);
         CheckVkResult(err);
     }
 }
@@ -292,7 +529,7 @@ void Graphics::SetupVulkanWindow(ImGui_ImplVulkanH_Window* wd, VkSurfaceKHR surf
 
     // Check for WSI support
     VkBool32 res;
-    vkGetPhysicalDeviceSurfaceSupportKHR(m_PhysicalDevice, m_QueueFamily, wd->Surface, &res);
+    m_Vk.vkGetPhysicalDeviceSurfaceSupportKHR(m_PhysicalDevice, m_QueueFamily, wd->Surface, &res);
     if (res != VK_TRUE) {
         Log::Message("Error no WSI support on physical device 0");
         exit(Error::VKCreateFrameBufferFailed);
@@ -317,15 +554,14 @@ void Graphics::SetupVulkanWindow(ImGui_ImplVulkanH_Window* wd, VkSurfaceKHR surf
 }
 
 void Graphics::CleanupVulkan() {
-    vkDestroyDescriptorPool(m_Device, m_DescriptorPool, m_Allocator);
+    m_Vk.vkDestroyDescriptorPool(m_Device, m_DescriptorPool, m_Allocator);
 
 #ifdef IMGUI_VULKAN_DEBUG_REPORT
-    auto vkDestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) vkGetInstanceProcAddr(m_Instance, "vkDestroyDebugReportCallbackEXT");
-    vkDestroyDebugReportCallbackEXT(m_Instance, m_DebugReport, m_Allocator);
+    m_Vk.vkDestroyDebugReportCallbackEXT(m_Instance, m_DebugReport, m_Allocator);
 #endif
 
-    vkDestroyDevice(m_Device, m_Allocator);
-    vkDestroyInstance(m_Instance, m_Allocator);
+    m_Vk.vkDestroyDevice(m_Device, m_Allocator);
+    m_Vk.vkDestroyInstance(m_Instance, m_Allocator);
 }
 
 void Graphics::CleanupVulkanWindow() {
@@ -343,34 +579,34 @@ void Graphics::CheckVkResult(VkResult err) {
     }
 }
 
-void Graphics::FrameRender(ImDrawData *drawData) {
+bool Graphics::FrameRender(ImDrawData *drawData, ImGuiBackend backend) {
     ImGui_ImplVulkanH_Window* wd = &m_MainWindowData;
 
     VkResult err;
     VkSemaphore imageAcquiredSemaphore = wd->FrameSemaphores[wd->SemaphoreIndex].ImageAcquiredSemaphore;
     VkSemaphore renderCompleteSemaphore = wd->FrameSemaphores[wd->SemaphoreIndex].RenderCompleteSemaphore;
-    err = vkAcquireNextImageKHR(m_Device, wd->Swapchain, UINT64_MAX, imageAcquiredSemaphore, VK_NULL_HANDLE, &wd->FrameIndex);
+    err = m_Vk.vkAcquireNextImageKHR(m_Device, wd->Swapchain, UINT64_MAX, imageAcquiredSemaphore, VK_NULL_HANDLE, &wd->FrameIndex);
     if (err == VK_ERROR_OUT_OF_DATE_KHR || err == VK_SUBOPTIMAL_KHR) {
-        m_Application->SetSwapChainRebuild(true);
-        return;
+        m_Application->RequestSwapChainRebuild();
+        return false;
     }
     CheckVkResult(err);
 
     ImGui_ImplVulkanH_Frame* fd = &wd->Frames[wd->FrameIndex];
     {
-        err = vkWaitForFences(m_Device, 1, &fd->Fence, VK_TRUE, UINT64_MAX);
+        err = m_Vk.vkWaitForFences(m_Device, 1, &fd->Fence, VK_TRUE, UINT64_MAX);
         CheckVkResult(err);
 
-        err = vkResetFences(m_Device, 1, &fd->Fence);
+        err = m_Vk.vkResetFences(m_Device, 1, &fd->Fence);
         CheckVkResult(err);
     }
     {
-        err = vkResetCommandPool(m_Device, fd->CommandPool, 0);
+        err = m_Vk.vkResetCommandPool(m_Device, fd->CommandPool, 0);
         CheckVkResult(err);
         VkCommandBufferBeginInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         info.flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        err = vkBeginCommandBuffer(fd->CommandBuffer, &info);
+        err = m_Vk.vkBeginCommandBuffer(fd->CommandBuffer, &info);
         CheckVkResult(err);
     }
     {
@@ -382,14 +618,43 @@ void Graphics::FrameRender(ImDrawData *drawData) {
         info.renderArea.extent.height = wd->Height;
         info.clearValueCount = 1;
         info.pClearValues = &wd->ClearValue;
-        vkCmdBeginRenderPass(fd->CommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
+        m_Vk.vkCmdBeginRenderPass(fd->CommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
     }
 
     // Render dear imgui primitives into command buffer
-    ImGui_ImplVulkan_RenderDrawData(drawData, fd->CommandBuffer);
+    {
+        const auto start = std::chrono::steady_clock::now();
+        if (backend == ImGuiBackend::Stock) {
+            ImGui_ImplVulkan_RenderDrawData(drawData, fd->CommandBuffer);
+        } else {
+            m_ImGuiRenderer.RenderDrawData(drawData, fd->CommandBuffer, wd->FrameIndex);
+        }
+        const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        float& average = m_RenderStatsAccumulator.CpuTimeMs[static_cast<int>(backend)];
+        average = average == 0.0f ? elapsed.count() : average * 0.95f + elapsed.count() * 0.05f;
+        if (backend == ImGuiBackend::InTree) {
+            m_RenderStatsAccumulator.InTree = m_ImGuiRenderer.GetStats();
+        }
+
+        // Frames built before the main thread noticed a run switch still use the previous backend
+        if (m_Benchmark && static_cast<uint32_t>(backend) == m_Benchmark->GetCurrentRun()) {
+            // Only the in-tree path pays for the call timers, so instrumented timings would favour the stock renderer
+            if (!VulkanDispatch::IsInstrumented) {
+                m_Benchmark->AddSample("cpu_render_ms", elapsed.count());
+            }
+            if (backend == ImGuiBackend::InTree) {
+                const auto& stats = m_ImGuiRenderer.GetStats();
+                m_Benchmark->AddSample("draw_calls", stats.DrawCalls);
+                m_Benchmark->AddSample("merged_commands", stats.MergedCommands);
+                m_Benchmark->AddSample("descriptor_binds", stats.DescriptorBinds);
+                m_Benchmark->AddSample("scissor_updates", stats.ScissorUpdates);
+            }
+        }
+    }
 
     // Submit command buffer
-    vkCmdEndRenderPass(fd->CommandBuffer);
+    m_Vk.vkCmdEndRenderPass(fd->CommandBuffer);
     {
         VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
         VkSubmitInfo info = {};
@@ -402,17 +667,14 @@ void Graphics::FrameRender(ImDrawData *drawData) {
         info.signalSemaphoreCount = 1;
         info.pSignalSemaphores = &renderCompleteSemaphore;
 
-        err = vkEndCommandBuffer(fd->CommandBuffer);
+        err = m_Vk.vkEndCommandBuffer(fd->CommandBuffer);
         CheckVkResult(err);
-        err = vkQueueSubmit(m_Queue, 1, &info, fd->Fence);
+        err = m_Vk.vkQueueSubmit(m_Queue, 1, &info, fd->Fence);
         CheckVkResult(err);
     }
+    return true;
 }
 void Graphics::FramePresent() {
-    if (m_Application->GetSwapChainRebuild()) {
-        return;
-    }
-
     ImGui_ImplVulkanH_Window* wd = &m_MainWindowData;
     VkSemaphore renderCompleteSemaphore = wd->FrameSemaphores[wd->SemaphoreIndex].RenderCompleteSemaphore;
     VkPresentInfoKHR info = {};
@@ -422,9 +684,9 @@ void Graphics::FramePresent() {
     info.swapchainCount = 1;
     info.pSwapchains = &wd->Swapchain;
     info.pImageIndices = &wd->FrameIndex;
-    VkResult err = vkQueuePresentKHR(m_Queue, &info);
+    VkResult err = m_Vk.vkQueuePresentKHR(m_Queue, &info);
     if (err == VK_ERROR_OUT_OF_DATE_KHR || err == VK_SUBOPTIMAL_KHR) {
-        m_Application->SetSwapChainRebuild(true);
+        m_Application->RequestSwapChainRebuild();
         return;
     }
     CheckVkResult(err);
@@ -0,0 +1,651 @@
+#include "ImGuiRenderer.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include "Graphics.hpp"
+#include "Log.hpp"
+
+// SPIR-V of shaders/imgui.{vert,frag}; checked in, and regenerated at build time when glslc is available
+static const uint32_t s_VertexShaderSpv[] = {
+#include "imgui.vert.spv.inc"
+};
+
+static const uint32_t s_FragmentShaderSpv[] = {
+#include "imgui.frag.spv.inc"
+};
+
+// Geometry buffers start at this size and then only ever grow (doubling), so steady-state frames never reallocate.
+static constexpr VkDeviceSize s_MinGeometryBufferSize = 64 * 1024;
+
+ImGuiRenderer::~ImGuiRenderer() {
+    Shutdown();
+}
+
+void ImGuiRenderer::Init(const InitInfo& info) {
+    IM_ASSERT(info.Dispatch != nullptr);
+    IM_ASSERT(info.Device != VK_NULL_HANDLE);
+    IM_ASSERT(info.RenderPass != VK_NULL_HANDLE);
+    IM_ASSERT(info.DescriptorPool != VK_NULL_HANDLE);
+    IM_ASSERT(info.FrameCount > 0);
+    m_Info = info;
+    m_Vk = info.Dispatch;
+
+    VkPhysicalDeviceProperties properties;
+    m_Vk->vkGetPhysicalDeviceProperties(m_Info.PhysicalDevice, &properties);
+    m_BufferMemoryAlignment = std::max<VkDeviceSize>(m_BufferMemoryAlignment, properties.limits.nonCoherentAtomSize);
+
+    CreateDeviceObjects();
+    m_Frames.resize(m_Info.FrameCount);
+}
+
+void ImGuiRenderer::Shutdown() {
+    if (m_Info.Device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    for (auto& frame : m_Frames) {
+        DestroyBuffer(frame.Vertices);
+        DestroyBuffer(frame.Indices);
+    }
+    m_Frames.clear();
+
+    DestroyFontUploadObjects();
+    DestroyDeviceObjects();
+    m_Info = {};
+}
+
+void ImGuiRenderer::SetFrameCount(uint32_t frameCount) {
+    IM_ASSERT(frameCount > 0);
+    if (frameCount == m_Frames.size()) {
+        return;
+    }
+
+    for (size_t i = frameCount; i < m_Frames.size(); i++) {
+        DestroyBuffer(m_Frames[i].Vertices);
+        DestroyBuffer(m_Frames[i].Indices);
+    }
+    m_Frames.resize(frameCount);
+    m_Info.FrameCount = frameCount;
+}
+
+void ImGuiRenderer::CreateFontsTexture(VkCommandBuffer commandBuffer) {
+    VkResult err;
+    VkDevice device = m_Info.Device;
+    auto& io = ImGui::GetIO();
+
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    const VkDeviceSize uploadSize = static_cast<VkDeviceSize>(width) * height * 4;
+
+    // Create the Image
+    {
+        VkImageCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        info.imageType = VK_IMAGE_TYPE_2D;
+        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.extent.width = width;
+        info.extent.height = height;
+        info.extent.depth = 1;
+        info.mipLevels = 1;
+        info.arrayLayers = 1;
+        info.samples = VK_SAMPLE_COUNT_1_BIT;
+        info.tiling = VK_IMAGE_TILING_OPTIMAL;
+        info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        err = m_Vk->vkCreateImage(device, &info, m_Info.Allocator, &m_FontImage);
+        Graphics::CheckVkResult(err);
+
+        VkMemoryRequirements req;
+        m_Vk->vkGetImageMemoryRequirements(device, m_FontImage, &req);
+        VkMemoryAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = req.size;
+        allocInfo.memoryTypeIndex = FindMemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, req.memoryTypeBits);
+        err = m_Vk->vkAllocateMemory(device, &allocInfo, m_Info.Allocator, &m_FontMemory);
+        Graphics::CheckVkResult(err);
+        err = m_Vk->vkBindImageMemory(device, m_FontImage, m_FontMemory, 0);
+        Graphics::CheckVkResult(err);
+    }
+
+    // Create the Image View
+    {
+        VkImageViewCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        info.image = m_FontImage;
+        info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        info.subresourceRange.levelCount = 1;
+        info.subresourceRange.layerCount = 1;
+        err = m_Vk->vkCreateImageView(device, &info, m_Info.Allocator, &m_FontView);
+        Graphics::CheckVkResult(err);
+    }
+
+    // Create the Descriptor Set
+    {
+        VkDescriptorSetAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = m_Info.DescriptorPool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &m_DescriptorSetLayout;
+        err = m_Vk->vkAllocateDescriptorSets(device, &allocInfo, &m_FontDescriptorSet);
+        Graphics::CheckVkResult(err);
+
+        VkDescriptorImageInfo imageInfo = {};
+        imageInfo.sampler = m_FontSampler;
+        imageInfo.imageView = m_FontView;
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        VkWriteDescriptorSet write = {};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = m_FontDescriptorSet;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = &imageInfo;
+        m_Vk->vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+    }
+
+    // Create the Upload Buffer
+    {
+        VkBufferCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        info.size = uploadSize;
+        info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        err = m_Vk->vkCreateBuffer(device, &info, m_Info.Allocator, &m_UploadBuffer);
+        Graphics::CheckVkResult(err);
+
+        VkMemoryRequirements req;
+        m_Vk->vkGetBufferMemoryRequirements(device, m_UploadBuffer, &req);
+        VkMemoryAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = req.size;
+        allocInfo.memoryTypeIndex = FindMemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+        err = m_Vk->vkAllocateMemory(device, &allocInfo, m_Info.Allocator, &m_UploadBufferMemory);
+        Graphics::CheckVkResult(err);
+        err = m_Vk->vkBindBufferMemory(device, m_UploadBuffer, m_UploadBufferMemory, 0);
+        Graphics::CheckVkResult(err);
+    }
+
+    // Upload to Buffer
+    {
+        void* mapped = nullptr;
+        err = m_Vk->vkMapMemory(device, m_UploadBufferMemory, 0, uploadSize, 0, &mapped);
+        Graphics::CheckVkResult(err);
+        memcpy(mapped, pixels, static_cast<size_t>(uploadSize));
+        m_Vk->vkUnmapMemory(device, m_UploadBufferMemory);
+    }
+
+    // Copy to Image
+    {
+        VkImageMemoryBarrier copyBarrier = {};
+        copyBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        copyBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        copyBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        copyBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        copyBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copyBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copyBarrier.image = m_FontImage;
+        copyBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        copyBarrier.subresourceRange.levelCount = 1;
+        copyBarrier.subresourceRange.layerCount = 1;
+        m_Vk->vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &copyBarrier);
+
+        VkBufferImageCopy region = {};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent.width = width;
+        region.imageExtent.height = height;
+        region.imageExtent.depth = 1;
+        m_Vk->vkCmdCopyBufferToImage(commandBuffer, m_UploadBuffer, m_FontImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        VkImageMemoryBarrier useBarrier = {};
+        useBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        useBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        useBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        useBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        useBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        useBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        useBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        useBarrier.image = m_FontImage;
+        useBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        useBarrier.subresourceRange.levelCount = 1;
+        useBarrier.subresourceRange.layerCount = 1;
+        m_Vk->vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &useBarrier);
+    }
+}
+
+void ImGuiRenderer::DestroyFontUploadObjects() {
+    if (m_UploadBuffer) {
+        m_Vk->vkDestroyBuffer(m_Info.Device, m_UploadBuffer, m_Info.Allocator);
+        m_UploadBuffer = VK_NULL_HANDLE;
+    }
+    if (m_UploadBufferMemory) {
+        m_Vk->vkFreeMemory(m_Info.Device, m_UploadBufferMemory, m_Info.Allocator);
+        m_UploadBufferMemory = VK_NULL_HANDLE;
+    }
+}
+
+void ImGuiRenderer::RenderDrawData(ImDrawData* drawData, VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+    m_Stats = {};
+
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    const int fbWidth = static_cast<int>(drawData->DisplaySize.x * drawData->FramebufferScale.x);
+    const int fbHeight = static_cast<int>(drawData->DisplaySize.y * drawData->FramebufferScale.y);
+    if (fbWidth <= 0 || fbHeight <= 0 || drawData->CmdListsCount == 0) {
+        return;
+    }
+
+    IM_ASSERT(frameIndex < m_Frames.size());
+    FrameGeometry& frame = m_Frames[frameIndex];
+
+    // Copy every draw list into the persistently mapped buffers in one pass (memory is host coherent, no flush needed)
+    if (drawData->TotalVtxCount > 0) {
+        EnsureCapacity(frame.Vertices, drawData->TotalVtxCount * sizeof(ImDrawVert), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+        EnsureCapacity(frame.Indices, drawData->TotalIdxCount * sizeof(ImDrawIdx), VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+        auto* vtxDst = static_cast<ImDrawVert*>(frame.Vertices.Mapped);
+        auto* idxDst = static_cast<ImDrawIdx*>(frame.Indices.Mapped);
+        for (int n = 0; n < drawData->CmdListsCount; n++) {
+            const ImDrawList* cmdList = drawData->CmdLists[n];
+            memcpy(vtxDst, cmdList->VtxBuffer.Data, cmdList->VtxBuffer.Size * sizeof(ImDrawVert));
+            memcpy(idxDst, cmdList->IdxBuffer.Data, cmdList->IdxBuffer.Size * sizeof(ImDrawIdx));
+            vtxDst += cmdList->VtxBuffer.Size;
+            idxDst += cmdList->IdxBuffer.Size;
+        }
+    }
+
+    SetupRenderState(drawData, commandBuffer, frame, fbWidth, fbHeight);
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    const ImVec2 clipOff = drawData->DisplayPos;
+    const ImVec2 clipScale = drawData->FramebufferScale;
+
+    // Currently bound state; a null descriptor set / invalid scissor forces the next command to rebind.
+    VkDescriptorSet boundSet = VK_NULL_HANDLE;
+    VkRect2D boundScissor = {};
+    bool scissorValid = false;
+
+    // Draw being accumulated; consecutive commands extend it while their state and index ranges line up.
+    uint32_t pendingIndexCount = 0;
+    uint32_t pendingFirstIndex = 0;
+    int32_t pendingVertexOffset = 0;
+    auto flush = [&]() {
+        if (pendingIndexCount == 0) {
+            return;
+        }
+        m_Vk->vkCmdDrawIndexed(commandBuffer, pendingIndexCount, 1, pendingFirstIndex, pendingVertexOffset, 0);
+        m_Stats.DrawCalls++;
+        pendingIndexCount = 0;
+    };
+
+    int globalVtxOffset = 0;
+    int globalIdxOffset = 0;
+    for (int n = 0; n < drawData->CmdListsCount; n++) {
+        const ImDrawList* cmdList = drawData->CmdLists[n];
+        for (int i = 0; i < cmdList->CmdBuffer.Size; i++) {
+            const ImDrawCmd* pcmd = &cmdList->CmdBuffer[i];
+            if (pcmd->UserCallback != nullptr) {
+                flush();
+                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState) {
+                    SetupRenderState(drawData, commandBuffer, frame, fbWidth, fbHeight);
+                } else {
+                    pcmd->UserCallback(cmdList, pcmd);
+                }
+                boundSet = VK_NULL_HANDLE;
+                scissorValid = false;
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space, clamped to the viewport
+            ImVec2 clipMin((pcmd->ClipRect.x - clipOff.x) * clipScale.x, (pcmd->ClipRect.y - clipOff.y) * clipScale.y);
+            ImVec2 clipMax((pcmd->ClipRect.z - clipOff.x) * clipScale.x, (pcmd->ClipRect.w - clipOff.y) * clipScale.y);
+            if (clipMin.x < 0.0f) { clipMin.x = 0.0f; }
+            if (clipMin.y < 0.0f) { clipMin.y = 0.0f; }
+            if (clipMax.x > fbWidth) { clipMax.x = static_cast<float>(fbWidth); }
+            if (clipMax.y > fbHeight) { clipMax.y = static_cast<float>(fbHeight); }
+            if (clipMax.x <= clipMin.x || clipMax.y <= clipMin.y) {
+                continue;
+            }
+
+            VkRect2D scissor;
+            scissor.offset.x = static_cast<int32_t>(clipMin.x);
+            scissor.offset.y = static_cast<int32_t>(clipMin.y);
+            scissor.extent.width = static_cast<uint32_t>(clipMax.x - clipMin.x);
+            scissor.extent.height = static_cast<uint32_t>(clipMax.y - clipMin.y);
+
+            const auto descriptorSet = (VkDescriptorSet) pcmd->GetTexID();
+            const uint32_t firstIndex = pcmd->IdxOffset + globalIdxOffset;
+            const int32_t vertexOffset = static_cast<int32_t>(pcmd->VtxOffset) + globalVtxOffset;
+            const bool sameScissor = scissorValid &&
+                scissor.offset.x == boundScissor.offset.x && scissor.offset.y == boundScissor.offset.y &&
+                scissor.extent.width == boundScissor.extent.width && scissor.extent.height == boundScissor.extent.height;
+
+            if (descriptorSet == boundSet && sameScissor && pendingIndexCount > 0 &&
+                pendingVertexOffset == vertexOffset && pendingFirstIndex + pendingIndexCount == firstIndex) {
+                pendingIndexCount += pcmd->ElemCount;
+                m_Stats.MergedCommands++;
+                continue;
+            }
+
+            flush();
+            if (descriptorSet != boundSet) {
+                m_Vk->vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+                boundSet = descriptorSet;
+                m_Stats.DescriptorBinds++;
+            }
+            if (!sameScissor) {
+                m_Vk->vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+                boundScissor = scissor;
+                scissorValid = true;
+                m_Stats.ScissorUpdates++;
+            }
+            pendingIndexCount = pcmd->ElemCount;
+            pendingFirstIndex = firstIndex;
+            pendingVertexOffset = vertexOffset;
+        }
+        globalIdxOffset += cmdList->IdxBuffer.Size;
+        globalVtxOffset += cmdList->VtxBuffer.Size;
+    }
+    flush();
+
+    // Restore a full-framebuffer scissor, so later passes recorded into this command buffer are not clipped
+    VkRect2D scissor = { { 0, 0 }, { static_cast<uint32_t>(fbWidth), static_cast<uint32_t>(fbHeight) } };
+    m_Vk->vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+}
+
+void ImGuiRenderer::SetupRenderState(ImDrawData* drawData, VkCommandBuffer commandBuffer, FrameGeometry& frame, int fbWidth, int fbHeight) {
+    m_Vk->vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline);
+
+    if (drawData->TotalVtxCount > 0) {
+        VkDeviceSize vertexOffset = 0;
+        m_Vk->vkCmdBindVertexBuffers(commandBuffer, 0, 1, &frame.Vertices.Buffer, &vertexOffset);
+        m_Vk->vkCmdBindIndexBuffer(commandBuffer, frame.Indices.Buffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+    }
+
+    VkViewport viewport;
+    viewport.x = 0;
+    viewport.y = 0;
+    viewport.width = static_cast<float>(fbWidth);
+    viewport.height = static_cast<float>(fbHeight);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    m_Vk->vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+
+    // Our visible imgui space lies from DisplayPos (top left) to DisplayPos + DisplaySize (bottom right).
+    float constants[4];
+    constants[0] = 2.0f / drawData->DisplaySize.x;
+    constants[1] = 2.0f / drawData->DisplaySize.y;
+    constants[2] = -1.0f - drawData->DisplayPos.x * constants[0];
+    constants[3] = -1.0f - drawData->DisplayPos.y * constants[1];
+    m_Vk->vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(constants), constants);
+}
+
+void ImGuiRenderer::EnsureCapacity(GeometryBuffer& buffer, VkDeviceSize size, VkBufferUsageFlags usage) {
+    if (buffer.Buffer != VK_NULL_HANDLE && buffer.Size >= size) {
+        return;
+    }
+
+    VkResult err;
+    VkDevice device = m_Info.Device;
+    VkDeviceSize newSize = std::max(std::max(s_MinGeometryBufferSize, buffer.Size * 2), size);
+    newSize = ((newSize - 1) / m_BufferMemoryAlignment + 1) * m_BufferMemoryAlignment;
+    DestroyBuffer(buffer);
+
+    VkBufferCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    info.size = newSize;
+    info.usage = usage;
+    info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    err = m_Vk->vkCreateBuffer(device, &info, m_Info.Allocator, &buffer.Buffer);
+    Graphics::CheckVkResult(err);
+
+    VkMemoryRequirements req;
+    m_Vk->vkGetBufferMemoryRequirements(device, buffer.Buffer, &req);
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = req.size;
+    allocInfo.memoryTypeIndex = FindMemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    err = m_Vk->vkAllocateMemory(device, &allocInfo, m_Info.Allocator, &buffer.Memory);
+    Graphics::CheckVkResult(err);
+    err = m_Vk->vkBindBufferMemory(device, buffer.Buffer, buffer.Memory, 0);
+    Graphics::CheckVkResult(err);
+
+    // Mapped once for the buffer's whole lifetime
+    err = m_Vk->vkMapMemory(device, buffer.Memory, 0, VK_WHOLE_SIZE, 0, &buffer.Mapped);
+    Graphics::CheckVkResult(err);
+    buffer.Size = newSize;
+}
+
+void ImGuiRenderer::DestroyBuffer(GeometryBuffer& buffer) {
+    if (buffer.Mapped) {
+        m_Vk->vkUnmapMemory(m_Info.Device, buffer.Memory);
+        buffer.Mapped = nullptr;
+    }
+    if (buffer.Buffer) {
+        m_Vk->vkDestroyBuffer(m_Info.Device, buffer.Buffer, m_Info.Allocator);
+        buffer.Buffer = VK_NULL_HANDLE;
+    }
+    if (buffer.Memory) {
+        m_Vk->vkFreeMemory(m_Info.Device, buffer.Memory, m_Info.Allocator);
+        buffer.Memory = VK_NULL_HANDLE;
+    }
+    // Size is kept on purpose: it seeds the next allocation, so a rebuilt buffer never starts smaller.
+}
+
+void ImGuiRenderer::CreateDeviceObjects() {
+    VkResult err;
+    VkDevice device = m_Info.Device;
+
+    // Create Font Sampler
+    {
+        VkSamplerCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        info.magFilter = VK_FILTER_LINEAR;
+        info.minFilter = VK_FILTER_LINEAR;
+        info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        info.minLod = -1000;
+        info.maxLod = 1000;
+        info.maxAnisotropy = 1.0f;
+        err = m_Vk->vkCreateSampler(device, &info, m_Info.Allocator, &m_FontSampler);
+        Graphics::CheckVkResult(err);
+    }
+
+    // Create Descriptor Set Layout and Pipeline Layout
+    {
+        VkDescriptorSetLayoutBinding binding[1] = {};
+        binding[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding[0].descriptorCount = 1;
+        binding[0].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        VkDescriptorSetLayoutCreateInfo setLayoutInfo = {};
+        setLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        setLayoutInfo.bindingCount = 1;
+        setLayoutInfo.pBindings = binding;
+        err = m_Vk->vkCreateDescriptorSetLayout(device, &setLayoutInfo, m_Info.Allocator, &m_DescriptorSetLayout);
+        Graphics::CheckVkResult(err);
+
+        // Constants: we are using 'vec2 offset' and 'vec2 scale' instead of a full 3d projection matrix
+        VkPushConstantRange pushConstants[1] = {};
+        pushConstants[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        pushConstants[0].offset = 0;
+        pushConstants[0].size = sizeof(float) * 4;
+        VkPipelineLayoutCreateInfo layoutInfo = {};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        layoutInfo.setLayoutCount = 1;
+        layoutInfo.pSetLayouts = &m_DescriptorSetLayout;
+        layoutInfo.pushConstantRangeCount = 1;
+        layoutInfo.pPushConstantRanges = pushConstants;
+        err = m_Vk->vkCreatePipelineLayout(device, &layoutInfo, m_Info.Allocator, &m_PipelineLayout);
+        Graphics::CheckVkResult(err);
+    }
+
+    // Create Pipeline
+    {
+        VkShaderModule vertexModule, fragmentModule;
+        VkShaderModuleCreateInfo moduleInfo = {};
+        moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleInfo.codeSize = sizeof(s_VertexShaderSpv);
+        moduleInfo.pCode = s_VertexShaderSpv;
+        err = m_Vk->vkCreateShaderModule(device, &moduleInfo, m_Info.Allocator, &vertexModule);
+        Graphics::CheckVkResult(err);
+        moduleInfo.codeSize = sizeof(s_FragmentShaderSpv);
+        moduleInfo.pCode = s_FragmentShaderSpv;
+        err = m_Vk->vkCreateShaderModule(device, &moduleInfo, m_Info.Allocator, &fragmentModule);
+        Graphics::CheckVkResult(err);
+
+        VkPipelineShaderStageCreateInfo stages[2] = {};
+        stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stages[0].module = vertexModule;
+        stages[0].pName = "main";
+        stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        stages[1].module = fragmentModule;
+        stages[1].pName = "main";
+
+        VkVertexInputBindingDescription bindingDesc[1] = {};
+        bindingDesc[0].stride = sizeof(ImDrawVert);
+        bindingDesc[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+        VkVertexInputAttributeDescription attributeDesc[3] = {};
+        attributeDesc[0].location = 0;
+        attributeDesc[0].binding = bindingDesc[0].binding;
+        attributeDesc[0].format = VK_FORMAT_R32G32_SFLOAT;
+        attributeDesc[0].offset = IM_OFFSETOF(ImDrawVert, pos);
+        attributeDesc[1].location = 1;
+        attributeDesc[1].binding = bindingDesc[0].binding;
+        attributeDesc[1].format = VK_FORMAT_R32G32_SFLOAT;
+        attributeDesc[1].offset = IM_OFFSETOF(ImDrawVert, uv);
+        attributeDesc[2].location = 2;
+        attributeDesc[2].binding = bindingDesc[0].binding;
+        attributeDesc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
+        attributeDesc[2].offset = IM_OFFSETOF(ImDrawVert, col);
+
+        VkPipelineVertexInputStateCreateInfo vertexInfo = {};
+        vertexInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        vertexInfo.vertexBindingDescriptionCount = 1;
+        vertexInfo.pVertexBindingDescriptions = bindingDesc;
+        vertexInfo.vertexAttributeDescriptionCount = 3;
+        vertexInfo.pVertexAttributeDescriptions = attributeDesc;
+
+        VkPipelineInputAssemblyStateCreateInfo iaInfo = {};
+        iaInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        iaInfo.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        VkPipelineViewportStateCreateInfo viewportInfo = {};
+        viewportInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewportInfo.viewportCount = 1;
+        viewportInfo.scissorCount = 1;
+
+        VkPipelineRasterizationStateCreateInfo rasterInfo = {};
+        rasterInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterInfo.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterInfo.cullMode = VK_CULL_MODE_NONE;
+        rasterInfo.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        rasterInfo.lineWidth = 1.0f;
+
+        VkPipelineMultisampleStateCreateInfo msInfo = {};
+        msInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+        msInfo.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        VkPipelineColorBlendAttachmentState colorAttachment[1] = {};
+        colorAttachment[0].blendEnable = VK_TRUE;
+        colorAttachment[0].srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+        colorAttachment[0].dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        colorAttachment[0].colorBlendOp = VK_BLEND_OP_ADD;
+        colorAttachment[0].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        colorAttachment[0].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        colorAttachment[0].alphaBlendOp = VK_BLEND_OP_ADD;
+        colorAttachment[0].colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+        VkPipelineDepthStencilStateCreateInfo depthInfo = {};
+        depthInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+
+        VkPipelineColorBlendStateCreateInfo blendInfo = {};
+        blendInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        blendInfo.attachmentCount = 1;
+        blendInfo.pAttachments = colorAttachment;
+
+        VkDynamicState dynamicStates[2] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+        VkPipelineDynamicStateCreateInfo dynamicState = {};
+        dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamicState.dynamicStateCount = static_cast<uint32_t>(IM_ARRAYSIZE(dynamicStates));
+        dynamicState.pDynamicStates = dynamicStates;
+
+        VkGraphicsPipelineCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        info.stageCount = 2;
+        info.pStages = stages;
+        info.pVertexInputState = &vertexInfo;
+        info.pInputAssemblyState = &iaInfo;
+        info.pViewportState = &viewportInfo;
+        info.pRasterizationState = &rasterInfo;
+        info.pMultisampleState = &msInfo;
+        info.pDepthStencilState = &depthInfo;
+        info.pColorBlendState = &blendInfo;
+        info.pDynamicState = &dynamicState;
+        info.layout = m_PipelineLayout;
+        info.renderPass = m_Info.RenderPass;
+        info.subpass = 0;
+        err = m_Vk->vkCreateGraphicsPipelines(device, m_Info.PipelineCache, 1, &info, m_Info.Allocator, &m_Pipeline);
+        Graphics::CheckVkResult(err);
+
+        m_Vk->vkDestroyShaderModule(device, vertexModule, m_Info.Allocator);
+        m_Vk->vkDestroyShaderModule(device, fragmentModule, m_Info.Allocator);
+    }
+}
+
+void ImGuiRenderer::DestroyDeviceObjects() {
+    VkDevice device = m_Info.Device;
+
+    if (m_FontDescriptorSet) {
+        m_Vk->vkFreeDescriptorSets(device, m_Info.DescriptorPool, 1, &m_FontDescriptorSet);
+        m_FontDescriptorSet = VK_NULL_HANDLE;
+    }
+    if (m_FontView) {
+        m_Vk->vkDestroyImageView(device, m_FontView, m_Info.Allocator);
+        m_FontView = VK_NULL_HANDLE;
+    }
+    if (m_FontImage) {
+        m_Vk->vkDestroyImage(device, m_FontImage, m_Info.Allocator);
+        m_FontImage = VK_NULL_HANDLE;
+    }
+    if (m_FontMemory) {
+        m_Vk->vkFreeMemory(device, m_FontMemory, m_Info.Allocator);
+        m_FontMemory = VK_NULL_HANDLE;
+    }
+    if (m_Pipeline) {
+        m_Vk->vkDestroyPipeline(device, m_Pipeline, m_Info.Allocator);
+        m_Pipeline = VK_NULL_HANDLE;
+    }
+    if (m_PipelineLayout) {
+        m_Vk->vkDestroyPipelineLayout(device, m_PipelineLayout, m_Info.Allocator);
+        m_PipelineLayout = VK_NULL_HANDLE;
+    }
+    if (m_DescriptorSetLayout) {
+        m_Vk->vkDestroyDescriptorSetLayout(device, m_DescriptorSetLayout, m_Info.Allocator);
+        m_DescriptorSetLayout = VK_NULL_HANDLE;
+    }
+    if (m_FontSampler) {
+        m_Vk->vkDestroySampler(device, m_FontSampler, m_Info.Allocator);
+        m_FontSampler = VK_NULL_HANDLE;
+    }
+}
+
+uint32_t ImGuiRenderer::FindMemoryType(VkMemoryPropertyFlags properties, uint32_t typeBits) const {
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    m_Vk->vkGetPhysicalDeviceMemoryProperties(m_Info.PhysicalDevice, &memoryProperties);
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((memoryProperties.memoryTypes[i].propertyFlags & properties) == properties && (typeBits & (1u << i))) {
+            return i;
+        }
+    }
+
+    Log::Message("[ImGuiRenderer] Error: no memory type matches properties 0x%x", properties);
+    abort();
+}
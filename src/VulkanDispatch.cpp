@@ -0,0 +1,41 @@
+#include "VulkanDispatch.hpp"
+
+static const char* s_EntryNames[] = {
+#define VK_DISPATCH_ENTRY_NAME(name) #name,
+    VK_DISPATCH_ALL_FUNCTIONS(VK_DISPATCH_ENTRY_NAME)
+#undef VK_DISPATCH_ENTRY_NAME
+};
+static_assert(sizeof(s_EntryNames) / sizeof(s_EntryNames[0]) == VulkanDispatch::EntryCount, "entry name table out of sync");
+
+const char* VulkanDispatch::GetEntryName(uint32_t entry) {
+    return entry < EntryCount ? s_EntryNames[entry] : "unknown";
+}
+
+// vkGetInstanceProcAddr is the only symbol still taken from the loader; everything else is resolved through it.
+void VulkanDispatch::LoadGlobal() {
+#define VK_DISPATCH_LOAD_GLOBAL(name) Bind(name, reinterpret_cast<PFN_##name>(::vkGetInstanceProcAddr(VK_NULL_HANDLE, #name)), Entry_##name);
+    VK_DISPATCH_GLOBAL_FUNCTIONS(VK_DISPATCH_LOAD_GLOBAL)
+#undef VK_DISPATCH_LOAD_GLOBAL
+}
+
+void VulkanDispatch::LoadInstance(VkInstance instance) {
+#define VK_DISPATCH_LOAD_INSTANCE(name) Bind(name, reinterpret_cast<PFN_##name>(::vkGetInstanceProcAddr(instance, #name)), Entry_##name);
+    VK_DISPATCH_INSTANCE_FUNCTIONS(VK_DISPATCH_LOAD_INSTANCE)
+#undef VK_DISPATCH_LOAD_INSTANCE
+
+    // Kept as a raw pointer, so loading the device table does not show up in the call statistics
+    m_GetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(::vkGetInstanceProcAddr(instance, "vkGetDeviceProcAddr"));
+}
+
+void VulkanDispatch::LoadDevice(VkDevice device) {
+#define VK_DISPATCH_LOAD_DEVICE(name) Bind(name, reinterpret_cast<PFN_##name>(m_GetDeviceProcAddr(device, #name)), Entry_##name);
+    VK_DISPATCH_DEVICE_FUNCTIONS(VK_DISPATCH_LOAD_DEVICE)
+#undef VK_DISPATCH_LOAD_DEVICE
+}
+
+void VulkanDispatch::CollectFrameStats(VulkanCallStats (&stats)[EntryCount]) {
+    for (uint32_t i = 0; i < EntryCount; i++) {
+        stats[i] = m_Stats[i];
+        m_Stats[i] = {};
+    }
+}
@@ -1,8 +1,18 @@
 #include "Application.h"
 
+#include <cstdlib>
+#include <cstring>
+
 int main(int argc, char** argv) {
 
     Application app;
+
+    // Usage: vulkan_example [--benchmark [output.json] [widget count]]
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        const std::string outputPath = argc > 2 ? argv[2] : "benchmark.json";
+        const int widgetCount = argc > 3 ? std::atoi(argv[3]) : 20000;
+        app.EnableBenchmark(outputPath, widgetCount);
+    }
     app.Run();
 
     return 0;